@@ -72,7 +72,7 @@ static bool ReadMtxFile(const char file[], long long *n, long long **ap, long lo
                 --c;
                 (*ai)[ptr] = r;
                 (*ax)[ptr][0] = vr;
-                (*ax)[ptr][1] = vi;
+                (*ax)[ptr][1] = -vi; /*lower triangular part in CSC is conjugate of upper triangular part in CSR*/
                 if (c != pc)
                 {
                     (*ap)[c] = ptr;
@@ -248,7 +248,7 @@ int main(int argc, const char *argv[])
     printf("# Swapped pivots = %lld.\n", parm[8]);
     printf("# Perturbed pivots = %lld.\n", parm[11]);
 
-    ret = HYLU_CL_Solve(instance, 0, b, x);
+    ret = HYLU_CL_Solve(instance, 1, b, x);
     if (ret < 0)
     {
         printf("Triangular solve failed, return code = %d.\n", ret);
@@ -257,7 +257,7 @@ int main(int argc, const char *argv[])
     printf("Triangular solve time = %g.\n", parm[7] * 1.e-6);
     printf("# Refinements = %d.\n", (int)parm[16]);
 
-    res = L1NormOfResidual(n, ap, ai, ax, x, b, 0);
+    res = L1NormOfResidual(n, ap, ai, ax, x, b, 1);
     printf("Residual (||Ax-b||/||b||) = %g.\n", res);
 
     ret = HYLU_CL_Determinant(instance, &mantissa, &exponent);
@@ -208,7 +208,7 @@ int main(int argc, const char *argv[])
     printf("# Swapped pivots = %d.\n", (int)parm[8]);
     printf("# Perturbed pivots = %d.\n", (int)parm[11]);
 
-    ret = HYLU_Solve(instance, false, b, x);
+    ret = HYLU_Solve(instance, true, b, x);
     if (ret < 0)
     {
         printf("Triangular solve failed, return code = %d.\n", ret);
@@ -217,7 +217,7 @@ int main(int argc, const char *argv[])
     printf("Triangular solve time = %g.\n", parm[7] * 1.e-6);
     printf("# Refinements = %d.\n", (int)parm[16]);
 
-    res = L1NormOfResidual(n, ap, ai, ax, x, b, false);
+    res = L1NormOfResidual(n, ap, ai, ax, x, b, true);
     printf("Residual (||Ax-b||/||b||) = %g.\n", res);
 
     ret = HYLU_Determinant(instance, &mantissa, &exponent);
@@ -4,6 +4,11 @@
 * Unsymmetric, symmetric (Hermitian for complex numbers) indefinite, and symmetric (Hermitian for complex numbers) positive-definite (SPD) matrices are natively supported.
 * For symmetric matrices, CSR format must ONLY STORE UPPER TRIANGULAR PART (including diagonal).
 * For Hermitian complex number matrices, diagonal elements must be real numbers.
+* Compressed sparse COLUMN (CSC) arrays of an unsymmetric A can be passed directly without transposing: they are CSR arrays of A**T, so solve with trans=true (real) or mode=1 (complex) to get Ax=b.
+* With such CSC input, everything else also refers to A**T: HYLU_MSolve needs trans=true/mode=1 too, HYLU_ConditionNumber returns the infinity-norm condition number of A, parm[24] is a column index of A, and rperm/cperm of HYLU_Analyze2 permute columns/rows of A.
+* For symmetric matrices in CSC format, pass the LOWER triangular part (including diagonal); trans/mode is not used for symmetric matrices.
+* For Hermitian matrices, CSC LOWER triangular part is CSR upper triangular part of conj(A), so pass conjugated ax, or solve with conj(b) and conjugate the returned x.
+* Functions are not thread-safe on the same instance (each call writes the instance's parm array); serialize calls per instance, use separate instances for concurrent solves, or HYLU_MSolve for multiple right-hand sides.
 */
 
 #ifndef __HYLU_H__